@@ -0,0 +1,145 @@
+// BinaryIO.hpp
+#ifndef BINARY_IO_HPP
+#define BINARY_IO_HPP
+
+#include <bit>         // for endian
+#include <climits>     // for CHAR_BIT
+#include <concepts>    // for integral
+#include <cstddef>     // for size_t
+#include <istream>     // for istream
+#include <ostream>     // for ostream
+#include <span>        // for span
+#include <type_traits> // for is_trivially_copyable_v, is_integral_v
+#include <vector>      // for vector
+
+namespace detail {
+// Endianness convertors
+
+// Convert integral types to Little-endian byte order
+//
+template <std::integral T> T ToLittleEndian(T value) {
+  if constexpr (std::endian::native == std::endian::big) {
+    // reverse byte order
+    T reversed = 0;
+    for (size_t byteIndex = 0; byteIndex < sizeof(T); ++byteIndex) {
+      const T byteMask = 0xFF;
+      T sourceByte = ((value >> (byteIndex * CHAR_BIT)) & byteMask);
+      size_t destOffset = (sizeof(T) - 1 - byteIndex) * CHAR_BIT;
+      reversed |= sourceByte << destOffset;
+    }
+    return reversed;
+  } else {
+    return value; // no change required on Little-endian systems
+  }
+}
+
+// Convert integral types from Little-endian byte order
+//
+template <std::integral T> T FromLittleEndian(T value) {
+  return ToLittleEndian(value);
+}
+
+// Convert array of integral values to Little-endian byte order in place
+//
+template <std::integral T> void ToLittleEndian(std::span<T> values) {
+  if constexpr (std::endian::native == std::endian::big) {
+    for (T &value : values) {
+      value = ToLittleEndian(value);
+    }
+  }
+}
+
+// Convert array of integral values from Little-endian byte order in place
+//
+template <std::integral T> void FromLittleEndian(std::span<T> values) {
+  ToLittleEndian(values);
+}
+
+// Write raw bytes from value to output stream (os) taking into account
+// Endianess if value is integral type
+//
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+bool Write(std::ostream &os, const T &value) {
+  if constexpr (std::is_integral_v<T>) {
+    T le_value = ToLittleEndian(value);
+    os.write(reinterpret_cast<const char *>(&le_value), sizeof(T));
+  } else {
+    os.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+  return !os.fail();
+}
+
+// Overload for c-style strings
+// Write len chars from data to output stream (os)
+//
+inline bool Write(std::ostream &os, const char *data, size_t len) {
+  os.write(data, len);
+  return !os.fail();
+}
+
+// Write whole array of values to output stream (os) with a single write,
+// taking into account Endianess if values are integral type
+//
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+bool WriteArray(std::ostream &os, std::span<const T> values) {
+  if constexpr (std::is_integral_v<T> &&
+                std::endian::native == std::endian::big) {
+    std::vector<T> le_values(values.begin(), values.end());
+    ToLittleEndian(std::span<T>(le_values));
+    os.write(reinterpret_cast<const char *>(le_values.data()),
+             values.size_bytes());
+  } else {
+    os.write(reinterpret_cast<const char *>(values.data()),
+             values.size_bytes());
+  }
+  return !os.fail();
+}
+
+// Read raw bytes from istream (is) to value taking into account Endianess
+// if value is integral type
+//
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+bool Read(std::istream &is, T &value) {
+  is.read(reinterpret_cast<char *>(&value), sizeof(T));
+  if (is.fail() || is.gcount() != sizeof(T)) {
+    return false; // read error
+  }
+  if constexpr (std::is_integral_v<T>) {
+    value = FromLittleEndian(value);
+  }
+  return true;
+}
+
+// Overload for c-style strings
+// Read len chars from istream (is) to char buffer
+//
+inline bool Read(std::istream &is, char *buf, size_t len) {
+  is.read(buf, len);
+  if (is.fail() || static_cast<size_t>(is.gcount()) != len) {
+    return false; // read error
+  }
+  return true;
+}
+
+// Read whole array of values from istream (is) with a single read,
+// taking into account Endianess if values are integral type
+//
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+bool ReadArray(std::istream &is, std::span<T> values) {
+  is.read(reinterpret_cast<char *>(values.data()), values.size_bytes());
+  if (is.fail() || static_cast<size_t>(is.gcount()) != values.size_bytes()) {
+    return false; // read error
+  }
+  if constexpr (std::is_integral_v<T>) {
+    FromLittleEndian(values);
+  }
+  return true;
+}
+
+} // namespace detail
+
+#endif // BINARY_IO_HPP
@@ -2,114 +2,199 @@
 #ifndef LIST_HPP
 #define LIST_HPP
 
+#include <algorithm>      // for sort, is_sorted, lower_bound
+#include <concepts>       // for copyable, default_initializable
 #include <cstdint>        // for uint32_t
 #include <cstddef>        // for size_t, ptrdiff_t
 #include <iterator>       // for bidirectional_iterator_tag
-#include <memory>         // for unique_ptr
+#include <memory>         // for unique_ptr, make_unique
 #include <string>         // for string
 #include <unordered_map>  // for unordered_map
+#include <utility>        // for move, pair, exchange
 #include <vector>         // for vector
+#include "ListReclaimer.hpp" // for ListReclaimer
 
-struct ListNode {
-  ListNode *prev = nullptr; // указатель на предыдущий элемент или nullptr
-  ListNode *next = nullptr;
-  ListNode *rand = nullptr; // указатель на произвольный элемент данного
-                            // списка, либо `nullptr`
-  std::string data;         // произвольные пользовательские данные
+// Types which can be stored as node payload
+//
+template <typename T>
+concept ListPayload = std::default_initializable<T> && std::copyable<T> &&
+                      std::equality_comparable<T>;
+
+template <ListPayload T> struct BasicListNode {
+  BasicListNode *prev = nullptr; // указатель на предыдущий элемент или nullptr
+  BasicListNode *next = nullptr;
+  BasicListNode *rand = nullptr; // указатель на произвольный элемент данного
+                                 // списка, либо `nullptr`
+  T data;                        // произвольные пользовательские данные
 };
 
+using ListNode = BasicListNode<std::string>;
+
 // RAII Class list owner
 //
-class LinkedList {
+template <ListPayload T> class BasicLinkedList {
+public:
+  using value_type = T;
+  using node_type = BasicListNode<T>;
+
 private:
   // custom deleter for unique_ptr
   //
   struct Deleter {
-    void operator()(ListNode *head) const;
+    bool bulk = false; // nodes are one array allocated by clone()
+    ListReclaimer *reclaimer = nullptr; // release nodes in background
+
+    void operator()(node_type *head) const noexcept {
+      ListReclaimer::ReleaseFn release = bulk ? &releaseBulk : &releaseChain;
+      if (reclaimer) {
+        try {
+          if (reclaimer->enqueue(head, release))
+            return;
+        } catch (...) {
+          // queue lock failed, release on this thread
+        }
+      }
+      release(head);
+    }
+
+    static void releaseBulk(void *nodes) {
+      delete[] static_cast<node_type *>(nodes);
+    }
+
+    static void releaseChain(void *nodes) {
+      node_type *head = static_cast<node_type *>(nodes);
+      while (head) {
+        node_type *next = head->next;
+        delete head;
+        head = next;
+      }
+    }
   };
 
-  std::unique_ptr<ListNode, Deleter> head_; // list head
-  size_t size_ = 0;                         // number of nodes
+  std::unique_ptr<node_type, Deleter> head_; // list head
+  size_t size_ = 0;                          // number of nodes
 
 private:
   friend class ListBuilder; // create list from here
 
   // replace list by new one
   //
-  void setHead(ListNode *head) { head_.reset(head); }
+  void setHead(node_type *head) { head_.reset(head); }
   // size setter
   //
   void setSize(size_t size) { size_ = size; }
   // return ptr to head node and release ownership
   //
-  ListNode *releaseHead() { return head_.release(); }
+  node_type *releaseHead() { return head_.release(); }
+  // make list of <size> nodes allocated as one array, links prev/next
+  //
+  static BasicLinkedList adoptArray(std::unique_ptr<node_type[]> nodes,
+                                    size_t size);
 
 public:
-  LinkedList() = default;
+  BasicLinkedList() = default;
 
   // no copy
-  LinkedList(const LinkedList &) = delete;
-  LinkedList &operator=(const LinkedList &) = delete;
+  BasicLinkedList(const BasicLinkedList &) = delete;
+  BasicLinkedList &operator=(const BasicLinkedList &) = delete;
 
   // move
-  LinkedList(LinkedList &&) = default;
-  LinkedList &operator=(LinkedList &&) = default;
+  // constructed list takes reclaimer of <other>,
+  // assigned list keeps its own reclaimer
+  BasicLinkedList(BasicLinkedList &&) = default;
+  BasicLinkedList &operator=(BasicLinkedList &&other) noexcept {
+    if (this != &other) {
+      ListReclaimer *reclaimer = head_.get_deleter().reclaimer;
+      head_ = std::move(other.head_); // old nodes released via reclaimer
+      size_ = std::exchange(other.size_, 0);
+      setReclaimer(reclaimer);
+    }
+    return *this;
+  }
 
-  ~LinkedList() = default;
+  ~BasicLinkedList() = default;
 
   class iterator final {
   private:
-    using T = ListNode;
-    friend class LinkedList;
-    T *ptr_ = nullptr;
+    using Node = node_type;
+    friend class BasicLinkedList;
+    Node *ptr_ = nullptr;
 
-    iterator(T *ptr) noexcept : ptr_(ptr) {}
+    iterator(Node *ptr) noexcept : ptr_(ptr) {}
 
   public:
     using iterator_category = std::bidirectional_iterator_tag;
-    using value_type = T;
+    using value_type = Node;
     using difference_type = std::ptrdiff_t;
-    using reference = T &;
-    using pointer = T *;
+    using reference = Node &;
+    using pointer = Node *;
 
     iterator() = default;
     iterator(const iterator &) = default;
     iterator &operator=(const iterator &) = default;
 
-    reference operator*() const noexcept;
-    pointer operator->() const noexcept;
-    iterator &operator++() noexcept;
-    iterator operator++(int) noexcept;
-    iterator &operator--() noexcept;
-    iterator operator--(int) noexcept;
+    reference operator*() const noexcept { return *ptr_; }
+    pointer operator->() const noexcept { return ptr_; }
+    iterator &operator++() noexcept {
+      ptr_ = ptr_->next;
+      return *this;
+    }
+    iterator operator++(int) noexcept {
+      iterator copy{*this};
+      ptr_ = ptr_->next;
+      return copy;
+    }
+    iterator &operator--() noexcept {
+      ptr_ = ptr_->prev;
+      return *this;
+    }
+    iterator operator--(int) noexcept {
+      iterator copy{*this};
+      ptr_ = ptr_->prev;
+      return copy;
+    }
 
     auto operator<=>(const iterator &) const noexcept = default;
   };
 
   class const_iterator final {
   private:
-    using T = ListNode;
-    friend class LinkedList;
-    const T *ptr_ = nullptr;
+    using Node = node_type;
+    friend class BasicLinkedList;
+    const Node *ptr_ = nullptr;
 
   public:
     using iterator_category = std::bidirectional_iterator_tag;
-    using value_type = const T;
+    using value_type = const Node;
     using difference_type = std::ptrdiff_t;
-    using reference = const T &;
-    using pointer = const T *;
+    using reference = const Node &;
+    using pointer = const Node *;
 
     const_iterator() = default;
-    explicit const_iterator(const T *ptr) noexcept : ptr_(ptr) {}
+    explicit const_iterator(const Node *ptr) noexcept : ptr_(ptr) {}
     const_iterator(const const_iterator &) = default;
     const_iterator &operator=(const const_iterator &) = default;
 
-    const T &operator*() const noexcept;
-    pointer operator->() const noexcept;
-    const_iterator &operator++() noexcept;
-    const_iterator operator++(int) noexcept;
-    const_iterator &operator--() noexcept;
-    const_iterator operator--(int) noexcept;
+    reference operator*() const noexcept { return *ptr_; }
+    pointer operator->() const noexcept { return ptr_; }
+    const_iterator &operator++() noexcept {
+      ptr_ = ptr_->next;
+      return *this;
+    }
+    const_iterator operator++(int) noexcept {
+      const_iterator tmp{*this};
+      ptr_ = ptr_->next;
+      return tmp;
+    }
+    const_iterator &operator--() noexcept {
+      ptr_ = ptr_->prev;
+      return *this;
+    }
+    const_iterator operator--(int) noexcept {
+      const_iterator tmp{*this};
+      ptr_ = ptr_->prev;
+      return tmp;
+    }
 
     auto operator<=>(const const_iterator &) const noexcept = default;
   };
@@ -124,20 +209,235 @@ public:
   size_t size() const { return size_; }
   bool empty() const { return size_ == 0; }
 
-  friend bool operator==(const LinkedList &lhs, const LinkedList &rhs);
+  // opt-in deferred destruction: nodes are released by <reclaimer> thread,
+  // which must outlive the list (nullptr - release on destroying thread).
+  // Setting belongs to this list: kept when another list is move assigned
+  // to it, passed on when it is move constructed from
+  void setReclaimer(ListReclaimer *reclaimer) {
+    head_.get_deleter().reclaimer = reclaimer;
+  }
+
+  // deep copy: nodes are allocated as one array,
+  // rand pointers remapped by node position.
+  // Copy doesn't use reclaimer until setReclaimer() is called on it
+  BasicLinkedList clone() const;
 };
 
+// Flat index of list nodes: node address -> position, w/o hashing.
+// Nodes of one array (see clone()) are indexed by pointer arithmetic,
+// other lists by sorted node addresses: address range is split into
+// ~size() buckets, lookup searches only entries of one bucket
+//
+template <ListPayload T> class BasicNodeIndex {
+public:
+  using node_type = BasicListNode<T>;
+
+  static constexpr uint32_t NPOS{0xFFFFFFFF}; // node not in list
+
+private:
+  std::uintptr_t base_ = 0; // address of first node, if nodes are one array
+  size_t size_ = 0;
+  bool contiguous_ = true;
+  std::vector<std::pair<std::uintptr_t, uint32_t>> byAddress_;
+  std::vector<uint32_t> buckets_; // first entry of byAddress_ in each bucket
+  unsigned shift_ = 0;            // bucket of addr is (addr - base_) >> shift_
+
+  static std::uintptr_t address(const node_type *node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+
+public:
+  BasicNodeIndex() = default;
+
+  explicit BasicNodeIndex(const BasicLinkedList<T> &list) : size_(list.size()) {
+    if (list.empty())
+      return;
+
+    base_ = address(&*list.begin());
+    uint32_t idx = 0;
+    for (const auto &node : list) {
+      if (address(&node) != base_ + idx * sizeof(node_type)) {
+        contiguous_ = false;
+        break;
+      }
+      ++idx;
+    }
+    if (contiguous_)
+      return;
+
+    byAddress_.reserve(size_);
+    idx = 0;
+    for (const auto &node : list) {
+      byAddress_.emplace_back(address(&node), idx++);
+    }
+    // already ordered if nodes were allocated sequentially
+    if (!std::is_sorted(byAddress_.begin(), byAddress_.end()))
+      std::sort(byAddress_.begin(), byAddress_.end());
+
+    // buckets of 2^shift_ bytes over [lowest, highest] node address
+    base_ = byAddress_.front().first;
+    std::uintptr_t range = byAddress_.back().first - base_;
+    while ((range >> shift_) > size_)
+      ++shift_;
+    buckets_.resize((range >> shift_) + 2);
+    size_t entry = 0;
+    for (size_t bucket = 0; bucket < buckets_.size(); ++bucket) {
+      while (entry < size_ &&
+             ((byAddress_[entry].first - base_) >> shift_) < bucket)
+        ++entry;
+      buckets_[bucket] = static_cast<uint32_t>(entry);
+    }
+  }
+
+  // position of <node> in list or NPOS
+  uint32_t find(const node_type *node) const {
+    if (!node)
+      return NPOS;
+
+    std::uintptr_t addr = address(node);
+    if (contiguous_) {
+      if (addr < base_ || (addr - base_) % sizeof(node_type) != 0)
+        return NPOS;
+      size_t idx = (addr - base_) / sizeof(node_type);
+      return (idx < size_) ? static_cast<uint32_t>(idx) : NPOS;
+    }
+
+    if (addr < base_ || addr > byAddress_.back().first)
+      return NPOS;
+    size_t bucket = (addr - base_) >> shift_;
+    auto first = byAddress_.begin() + buckets_[bucket];
+    auto last = byAddress_.begin() + buckets_[bucket + 1];
+    auto it = std::lower_bound(first, last, std::pair{addr, uint32_t{0}});
+    return (it != last && it->first == addr) ? it->second : NPOS;
+  }
+};
+
+template <ListPayload T>
+BasicLinkedList<T>
+BasicLinkedList<T>::adoptArray(std::unique_ptr<node_type[]> nodes,
+                               size_t size) {
+  BasicLinkedList list;
+  if (size == 0)
+    return list;
+
+  // link prev/next
+  for (size_t i = 0; i < size; ++i) {
+    nodes[i].prev = (i > 0) ? &nodes[i - 1] : nullptr;
+    nodes[i].next = (i < size - 1) ? &nodes[i + 1] : nullptr;
+  }
+
+  list.head_ = std::unique_ptr<node_type, Deleter>(nodes.release(),
+                                                   Deleter{.bulk = true});
+  list.size_ = size;
+  return list;
+}
+
+template <ListPayload T> BasicLinkedList<T> BasicLinkedList<T>::clone() const {
+  auto nodes = std::make_unique<node_type[]>(size_);
+
+  // copy data, link rand by position of source rand node
+  BasicNodeIndex<T> index(*this);
+  size_t i = 0;
+  for (const auto &node : *this) {
+    nodes[i].data = node.data;
+    uint32_t randIdx = index.find(node.rand);
+    nodes[i].rand = (randIdx != index.NPOS) ? &nodes[randIdx] : nullptr;
+    ++i;
+  }
+
+  return adoptArray(std::move(nodes), size_);
+}
+
+using LinkedList = BasicLinkedList<std::string>;
+
 // Builder for list
 class ListBuilder {
 public:
   // build LinkedList from text file <filename>
   static LinkedList fromTextFile(const std::string &filename);
 
-  // build LinkedList from vector of strings and vector of random indexes
-  static LinkedList fromMemory(const std::vector<std::string> &data,
-                               const std::vector<uint32_t> &randIndices);
+  // build list from vector of payloads and vector of random indexes
+  template <ListPayload T>
+  static BasicLinkedList<T> fromMemory(const std::vector<T> &data,
+                                       const std::vector<uint32_t> &randIndices);
 };
 
-std::unordered_map<const ListNode *, uint32_t>
-buildIndexMap(const LinkedList &list);
+template <ListPayload T>
+BasicLinkedList<T>
+ListBuilder::fromMemory(const std::vector<T> &vdata,
+                        const std::vector<uint32_t> &randIndices) {
+  using Node = BasicListNode<T>;
+  const size_t size = vdata.size();
+
+  // all nodes in one array
+  auto nodes = std::make_unique<Node[]>(size);
+  for (size_t i = 0; i < size; ++i) {
+    nodes[i].data = vdata[i];
+  }
+
+  // link rand
+  for (size_t i = 0; i < size; ++i) {
+    if (randIndices[i] < static_cast<uint32_t>(size)) {
+      nodes[i].rand = &nodes[randIndices[i]];
+    }
+  }
+
+  return BasicLinkedList<T>::adoptArray(std::move(nodes), size);
+}
+
+template <ListPayload T>
+std::unordered_map<const BasicListNode<T> *, uint32_t>
+buildIndexMap(const BasicLinkedList<T> &list) {
+  std::unordered_map<const BasicListNode<T> *, uint32_t> indexes;
+
+  uint32_t idx = 0;
+  for (const auto &node : list) {
+    indexes[&node] = idx++;
+  }
+
+  return indexes;
+}
+
+template <ListPayload T>
+bool operator==(const BasicLinkedList<T> &lhs, const BasicLinkedList<T> &rhs) {
+  if (lhs.size() != rhs.size())
+    return false;
+
+  auto lhsIndexMap = buildIndexMap(lhs);
+  auto rhsIndexMap = buildIndexMap(rhs);
+
+  auto lhsIt = lhs.cbegin();
+  auto rhsIt = rhs.cbegin();
+
+  auto lhsEnd = lhs.cend();
+  auto rhsEnd = rhs.cend();
+  for (; (lhsIt != lhsEnd) && (rhsIt != rhsEnd); ++lhsIt, ++rhsIt) {
+    if (lhsIt->data != rhsIt->data)
+      return false;
+
+    if (lhsIt->rand == nullptr && rhsIt->rand == nullptr)
+      continue;
+    if (lhsIt->rand == nullptr || rhsIt->rand == nullptr)
+      return false;
+
+    auto lhsIdxIt = lhsIndexMap.find(lhsIt->rand);
+    auto rhsIdxIt = rhsIndexMap.find(rhsIt->rand);
+    if ((lhsIdxIt == lhsIndexMap.end()) || (rhsIdxIt == rhsIndexMap.end()))
+      return false;
+    if (lhsIdxIt->second != rhsIdxIt->second)
+      return false;
+  }
+
+  return true;
+}
+
+// std::string lists are instantiated once in List.cpp
+extern template class BasicLinkedList<std::string>;
+extern template LinkedList
+ListBuilder::fromMemory(const std::vector<std::string> &,
+                        const std::vector<uint32_t> &);
+extern template std::unordered_map<const ListNode *, uint32_t>
+buildIndexMap(const LinkedList &);
+extern template bool operator==(const LinkedList &, const LinkedList &);
+
 #endif // LIST_HPP
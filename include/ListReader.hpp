@@ -0,0 +1,79 @@
+// ListReader.hpp
+#ifndef LIST_READER_HPP
+#define LIST_READER_HPP
+
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint32_t
+#include <fstream>     // for ifstream
+#include <istream>     // for istream
+#include <string>      // for string
+#include <string_view> // for string_view
+
+// Result of ListReader operations
+//
+enum class ReadStatus {
+  Ok,              // record decoded
+  End,             // all NodesCount records decoded
+  OpenError,       // can't open input file
+  ReadError,       // short read or stream failure
+  InvalidDataSize, // dataLen > DATA_MAX_SZ
+};
+
+const char *toString(ReadStatus status);
+
+// One decoded node
+// data points into reader's buffer and is valid until next call of next()
+//
+struct ListRecord {
+  std::string_view data;
+  uint32_t idx = 0;     // own index
+  uint32_t randIdx = 0; // index of rand node or NULL_INDEX
+};
+
+// Pull decoder for std::string list binary format
+// (see ListSerializer.hpp), decodes one record per next() call.
+// Uses fixed-size buffer, memory usage doesn't depend on NodesCount
+//
+class ListReader {
+public:
+  static constexpr uint32_t NULL_INDEX{0xFFFFFFFF}; // -1
+  static constexpr size_t DATA_MAX_SZ = 1000;
+
+private:
+  std::ifstream file_;   // owned input, if constructed from filename
+  std::istream *input_;  // source of records
+  std::array<char, DATA_MAX_SZ> buf_; // data of last decoded record
+  uint32_t nodesCnt_ = 0;
+  uint32_t nextIdx_ = 0;
+  ReadStatus status_ = ReadStatus::Ok;
+
+  // read NodesCount header
+  //
+  void readHeader();
+
+public:
+  // read from binary file <filename>
+  explicit ListReader(const std::string &filename);
+  // read from stream, which must outlive reader
+  explicit ListReader(std::istream &input);
+
+  // no copy, no move: input_ may point to file_
+  ListReader(const ListReader &) = delete;
+  ListReader &operator=(const ListReader &) = delete;
+
+  ~ListReader() = default;
+
+  // decode next record to <record>
+  // returns Ok, End or sticky error status
+  ReadStatus next(ListRecord &record);
+
+  // Ok while records remain, End once all NodesCount records have been
+  // returned (already after next() returned Ok for the last one),
+  // or sticky error of header read / next()
+  ReadStatus status() const { return status_; }
+  // NodesCount from header
+  uint32_t nodeCount() const { return nodesCnt_; }
+};
+
+#endif // LIST_READER_HPP
@@ -0,0 +1,65 @@
+// ListReclaimer.hpp
+#ifndef LIST_RECLAIMER_HPP
+#define LIST_RECLAIMER_HPP
+
+#include <condition_variable> // for condition_variable
+#include <cstddef>            // for size_t
+#include <mutex>              // for mutex
+#include <thread>             // for thread
+#include <vector>             // for vector
+
+// Background release of destroyed lists' nodes
+// Lists opt in with LinkedList::setReclaimer(), their destruction only
+// queues nodes, which are freed by reclaimer thread.
+// Queue has fixed capacity: when it is full, nodes are released on
+// destroying thread
+//
+class ListReclaimer {
+public:
+  using ReleaseFn = void (*)(void *nodes);
+
+  static constexpr size_t DEFAULT_CAPACITY = 64;
+
+private:
+  struct Job {
+    void *nodes = nullptr;
+    ReleaseFn release = nullptr;
+  };
+
+  mutable std::mutex mutex_;
+  std::condition_variable hasWork_; // job queued or stop requested
+  std::condition_variable idle_;    // queue empty and no job running
+  std::vector<Job> queue_;          // ring buffer
+  size_t first_ = 0;                // index of oldest job
+  size_t count_ = 0;                // number of queued jobs
+  bool busy_ = false;               // job is running
+  bool stop_ = false;
+  std::thread worker_;
+
+private:
+  // reclaimer thread loop
+  //
+  void run();
+
+public:
+  explicit ListReclaimer(size_t capacity = DEFAULT_CAPACITY);
+
+  // no copy, no move: worker thread refers to this
+  ListReclaimer(const ListReclaimer &) = delete;
+  ListReclaimer &operator=(const ListReclaimer &) = delete;
+
+  // release all queued nodes and stop thread
+  ~ListReclaimer();
+
+  // queue <nodes> to be freed by release(nodes) on reclaimer thread
+  // returns false if queue is full
+  bool enqueue(void *nodes, ReleaseFn release);
+
+  // wait until all queued nodes are released
+  void drain();
+
+  // number of queued or running jobs
+  size_t pending() const;
+};
+
+#endif // LIST_RECLAIMER_HPP
@@ -2,52 +2,172 @@
 #ifndef LIST_SERIALIZER_HPP
 #define LIST_SERIALIZER_HPP
 
+#include <concepts>      // for same_as
 #include <cstddef>       // for size_t
 #include <cstdint>       // for uint32_t
+#include <fstream>       // for ifstream, ofstream
+#include <iostream>      // for cerr
+#include <span>          // for span
 #include <string>        // for string
-#include <unordered_map> // for unordered_map
+#include <type_traits>   // for is_trivially_copyable_v, is_pointer_v
+#include <utility>       // for exchange, move
 #include <vector>        // for vector
-class LinkedList;
-struct ListNode;
+#include "BinaryIO.hpp"  // for WriteArray, ReadArray, Write, Read
+#include "List.hpp"      // for BasicLinkedList, BasicNodeIndex, ListBuilder
+#include "ListReader.hpp" // for ListReader
 
-// Binary format:
+// Payloads of fixed size, serialized as raw bytes w/o length prefix.
+// Excluded: types with padding bytes (indeterminate bytes in file),
+// pointers (meaningless on disk) and bool (std::vector<bool> has no
+// contiguous storage)
+//
+template <typename T>
+concept FixedSizePayload =
+    ListPayload<T> && std::is_trivially_copyable_v<T> &&
+    (std::has_unique_object_representations_v<T> ||
+     std::is_floating_point_v<T>) &&
+    !std::is_pointer_v<T> && !std::same_as<T, bool>;
+
+template <typename T>
+concept SerializablePayload =
+    FixedSizePayload<T> || std::same_as<T, std::string>;
+
+// Binary format for std::string payload:
 //  NodesCount(32bit), [dataLen(32bit), data(dataLen bytes), randIdx(32bit)] *
 //  NodesCount times
+//  (ListReader decodes it record by record w/o building the list)
+//
+// Binary format for fixed size payload:
+//  NodesCount(32bit), [data(sizeof(T) bytes)] * NodesCount,
+//  [randIdx(32bit)] * NodesCount
+//  (integral payloads are stored Little-endian, other types as raw bytes)
 
-class ListSerializer {
+template <SerializablePayload T> class BasicListSerializer {
 private:
-  const LinkedList *list_;
-  std::unordered_map<const ListNode *, uint32_t> nodeToIdx_; // fast search
+  using List = BasicLinkedList<T>;
+
+  const List *list_;
+  BasicNodeIndex<T> nodeToIdx_; // fast search, w/o hashing
 
-  static constexpr uint32_t NULL_INDEX{0xFFFFFFFF}; // -1
-  static constexpr size_t DATA_MAX_SZ = 1000;
+  static constexpr uint32_t NULL_INDEX = ListReader::NULL_INDEX;
+  static constexpr size_t DATA_MAX_SZ = ListReader::DATA_MAX_SZ;
+  static_assert(NULL_INDEX == BasicNodeIndex<T>::NPOS,
+                "rand w/o node must be written as NULL_INDEX");
 
 private:
   uint32_t getNodeCount() const {
-    return static_cast<uint32_t>(nodeToIdx_.size());
+    return static_cast<uint32_t>(list_->size());
   }
 
-  static LinkedList buildList(const std::vector<std::string> &data,
-                              const std::vector<uint32_t> &randIndices);
+  static List buildList(const std::vector<T> &data,
+                        const std::vector<uint32_t> &randIndices) {
+    return ListBuilder::fromMemory(data, randIndices);
+  }
 
 public:
-  explicit ListSerializer(const LinkedList *list);
+  explicit BasicListSerializer(const List *list)
+      : list_(list), nodeToIdx_(*list) {}
 
   // no copy
-  ListSerializer(const ListSerializer &) = delete;
-  ListSerializer &operator=(const ListSerializer &) = delete;
+  BasicListSerializer(const BasicListSerializer &) = delete;
+  BasicListSerializer &operator=(const BasicListSerializer &) = delete;
 
   // move
-  ListSerializer(ListSerializer &&other) noexcept;
-  ListSerializer &operator=(ListSerializer &&other) noexcept;
+  BasicListSerializer(BasicListSerializer &&other) noexcept
+      : list_(std::exchange(other.list_, nullptr)),
+        nodeToIdx_(std::move(other.nodeToIdx_)) {}
+  BasicListSerializer &operator=(BasicListSerializer &&other) noexcept {
+    if (this != &other) {
+      list_ = std::exchange(other.list_, nullptr);
+      nodeToIdx_ = std::move(other.nodeToIdx_);
+    }
+    return *this;
+  }
 
-  ~ListSerializer() = default;
+  ~BasicListSerializer() = default;
 
   // Write
   bool toBinaryFile(const std::string &outFilename) const;
 
   // Read
-  static LinkedList fromBinaryFile(const std::string &inputFilename);
+  static List fromBinaryFile(const std::string &inputFilename);
 };
 
+using ListSerializer = BasicListSerializer<std::string>;
+
+// std::string payload is length prefixed, see ListSerializer.cpp
+template <>
+bool BasicListSerializer<std::string>::toBinaryFile(
+    const std::string &outFilename) const;
+template <>
+LinkedList
+BasicListSerializer<std::string>::fromBinaryFile(const std::string &inputFilename);
+
+// Fixed size payload: data and rand indices are gathered into flat arrays
+// and written / read with one bulk operation each, restored list is
+// one node array
+//
+template <SerializablePayload T>
+bool BasicListSerializer<T>::toBinaryFile(const std::string &outFilename) const {
+  std::ofstream out(outFilename, std::ios::binary);
+  if (!out.is_open()) {
+    std::cerr << "Can't open file\n";
+    return false;
+  }
+
+  /*  write nodesCnt */
+  uint32_t nodesCnt = getNodeCount();
+  if (!detail::Write(out, nodesCnt)) {
+    std::cerr << "write error\n";
+    return false;
+  }
+
+  std::vector<T> data;
+  std::vector<uint32_t> randIndices;
+  data.reserve(nodesCnt);
+  randIndices.reserve(nodesCnt);
+
+  for (const auto &node : *list_) {
+    data.push_back(node.data);
+    randIndices.push_back(nodeToIdx_.find(node.rand));
+  }
+
+  /* write data array, then rand index array */
+  if (!detail::WriteArray(out, std::span<const T>(data)) ||
+      !detail::WriteArray(out, std::span<const uint32_t>(randIndices))) {
+    std::cerr << "write error\n";
+    return false;
+  }
+  return true;
+}
+
+template <SerializablePayload T>
+BasicLinkedList<T>
+BasicListSerializer<T>::fromBinaryFile(const std::string &inputFilename) {
+  std::ifstream input(inputFilename, std::ios::binary);
+  if (!input.is_open()) {
+    std::cerr << "Can't open file " << inputFilename << '\n';
+    return {};
+  }
+
+  // read nodesCnt
+  uint32_t nodesCnt;
+  if (!detail::Read(input, nodesCnt)) {
+    std::cerr << "Read error\n";
+    return {};
+  }
+
+  std::vector<T> data(nodesCnt);
+  std::vector<uint32_t> randIndices(nodesCnt);
+
+  // read data array, then rand index array
+  if (!detail::ReadArray(input, std::span<T>(data)) ||
+      !detail::ReadArray(input, std::span<uint32_t>(randIndices))) {
+    std::cerr << "Read error\n";
+    return {};
+  }
+
+  return buildList(data, randIndices);
+}
+
 #endif // LIST_SERIALIZER_HPP
@@ -0,0 +1,78 @@
+// ListReader.cpp
+#include <cstddef>         // for size_t
+#include <cstdint>         // for uint32_t
+#include <fstream>         // for ifstream
+#include <istream>         // for istream
+#include <string>          // for string
+#include <string_view>     // for string_view
+#include "BinaryIO.hpp"    // for Read
+#include "ListReader.hpp"  // for ListReader, ListRecord, ReadStatus
+
+using detail::Read;
+
+const char *toString(ReadStatus status) {
+  switch (status) {
+  case ReadStatus::Ok:
+    return "Ok";
+  case ReadStatus::End:
+    return "End of list";
+  case ReadStatus::OpenError:
+    return "Can't open file";
+  case ReadStatus::ReadError:
+    return "Read error";
+  case ReadStatus::InvalidDataSize:
+    return "Invalid data size";
+  }
+  return "Unknown status";
+}
+
+ListReader::ListReader(const std::string &filename)
+    : file_(filename, std::ios::binary), input_(&file_) {
+  if (!file_.is_open()) {
+    status_ = ReadStatus::OpenError;
+    return;
+  }
+  readHeader();
+}
+
+ListReader::ListReader(std::istream &input) : input_(&input) { readHeader(); }
+
+void ListReader::readHeader() {
+  if (!Read(*input_, nodesCnt_)) {
+    status_ = ReadStatus::ReadError;
+    return;
+  }
+  if (nodesCnt_ == 0)
+    status_ = ReadStatus::End;
+}
+
+// Record: dataLen(32bit), data(dataLen bytes), randIdx(32bit)
+//
+ReadStatus ListReader::next(ListRecord &record) {
+  if (status_ != ReadStatus::Ok)
+    return status_;
+
+  // read data length
+  uint32_t dataLen;
+  if (!Read(*input_, dataLen))
+    return status_ = ReadStatus::ReadError;
+  if (dataLen > DATA_MAX_SZ)
+    return status_ = ReadStatus::InvalidDataSize;
+
+  // read data
+  if (!Read(*input_, buf_.data(), static_cast<size_t>(dataLen)))
+    return status_ = ReadStatus::ReadError;
+
+  // read rand index
+  uint32_t randIdx;
+  if (!Read(*input_, randIdx))
+    return status_ = ReadStatus::ReadError;
+
+  record.data = std::string_view(buf_.data(), dataLen);
+  record.idx = nextIdx_++;
+  record.randIdx = randIdx;
+
+  if (nextIdx_ == nodesCnt_)
+    status_ = ReadStatus::End;
+  return ReadStatus::Ok;
+}
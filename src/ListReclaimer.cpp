@@ -0,0 +1,61 @@
+// ListReclaimer.cpp
+#include <cstddef>            // for size_t
+#include <mutex>              // for unique_lock, lock_guard
+#include "ListReclaimer.hpp"  // for ListReclaimer
+
+ListReclaimer::ListReclaimer(size_t capacity)
+    : queue_(capacity > 0 ? capacity : 1), worker_(&ListReclaimer::run, this) {}
+
+ListReclaimer::~ListReclaimer() {
+  {
+    std::lock_guard lock(mutex_);
+    stop_ = true;
+  }
+  hasWork_.notify_one();
+  worker_.join();
+}
+
+void ListReclaimer::run() {
+  std::unique_lock lock(mutex_);
+  while (true) {
+    hasWork_.wait(lock, [this] { return stop_ || count_ > 0; });
+    if (count_ == 0)
+      return; // stop requested, queue is empty
+
+    Job job = queue_[first_];
+    first_ = (first_ + 1) % queue_.size();
+    --count_;
+    busy_ = true;
+
+    lock.unlock();
+    job.release(job.nodes);
+    lock.lock();
+
+    busy_ = false;
+    if (count_ == 0)
+      idle_.notify_all();
+  }
+}
+
+bool ListReclaimer::enqueue(void *nodes, ReleaseFn release) {
+  {
+    std::lock_guard lock(mutex_);
+    if (stop_ || count_ == queue_.size())
+      return false;
+
+    queue_[(first_ + count_) % queue_.size()] = Job{nodes, release};
+    ++count_;
+  }
+  hasWork_.notify_one();
+  return true;
+}
+
+void ListReclaimer::drain() {
+  std::unique_lock lock(mutex_);
+  idle_.wait(lock, [this] { return count_ == 0 && !busy_; });
+}
+
+size_t ListReclaimer::pending() const {
+  std::lock_guard lock(mutex_);
+  return count_ + (busy_ ? 1 : 0);
+}
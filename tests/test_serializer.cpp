@@ -1,8 +1,16 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <latch>
 #include <string_view>
 #include <fstream>
+#include <sstream>
+#include <thread>
 
 #include "List.hpp"
+#include "ListReader.hpp"
+#include "ListReclaimer.hpp"
 #include "ListSerializer.hpp"
 
 struct ListSerializerTest
@@ -57,3 +65,293 @@ TEST_F(ListSerializerTest, CorrectRawData) {
     EXPECT_EQ(etalon, result) << "Data mismatch";
 }
 
+TEST(FixedSizeSerializerTest, CorrectRawData) {
+    BasicLinkedList<uint32_t> list =
+        ListBuilder::fromMemory<uint32_t>({7, 0x01020304, 42}, {2, 0xFFFFFFFF, 1});
+    BasicListSerializer<uint32_t> ls{&list};
+
+    std::string outFile = "outlet_fixed.out";
+    EXPECT_TRUE(ls.toBinaryFile(outFile)) << "Error openning file";
+
+    std::ifstream file(outFile, std::ios::binary);
+    std::stringstream buf;
+    if (file) {
+        buf << file.rdbuf();
+        file.close();
+    }
+    std::string_view result = buf.view();
+
+    // no length prefix: count, data array, rand index array
+    std::string etalon {
+        std::string("\x03\x00\x00\x00", 4)
+        + std::string("\x07\x00\x00\x00", 4)
+        + std::string("\x04\x03\x02\x01", 4)
+        + std::string("\x2A\x00\x00\x00", 4)
+        + std::string("\x02\x00\x00\x00", 4)
+        + std::string("\xFF\xFF\xFF\xFF", 4)
+        + std::string("\x01\x00\x00\x00", 4)
+    };
+
+    EXPECT_EQ(etalon, result) << "Data mismatch";
+}
+
+TEST(FixedSizeSerializerTest, StructRoundTrip) {
+    struct Point {
+        int32_t x = 0;
+        int32_t y = 0;
+        bool operator==(const Point &) const = default;
+    };
+
+    BasicLinkedList<Point> list = ListBuilder::fromMemory<Point>(
+        {{1, 2}, {3, 4}, {5, 6}, {7, 8}}, {3, 3, 0xFFFFFFFF, 0});
+    BasicListSerializer<Point> ls{&list};
+
+    std::string outFile = "outlet_point.out";
+    ASSERT_TRUE(ls.toBinaryFile(outFile));
+
+    BasicLinkedList<Point> restored =
+        BasicListSerializer<Point>::fromBinaryFile(outFile);
+    EXPECT_EQ(list.size(), restored.size());
+    EXPECT_TRUE(list == restored);
+}
+
+TEST_F(ListSerializerTest, ReaderYieldsRecords) {
+    std::string outFile = "outlet_reader.out";
+    ASSERT_TRUE(ls.toBinaryFile(outFile));
+
+    ListReader reader(outFile);
+    ASSERT_EQ(ReadStatus::Ok, reader.status());
+    EXPECT_EQ(3u, reader.nodeCount());
+
+    std::vector<std::string> data;
+    std::vector<uint32_t> randIndices;
+    ListRecord record;
+    while (reader.next(record) == ReadStatus::Ok) {
+        EXPECT_EQ(data.size(), record.idx);
+        data.emplace_back(record.data);
+        randIndices.push_back(record.randIdx);
+    }
+    EXPECT_EQ(ReadStatus::End, reader.status());
+
+    std::vector<std::string> expectedData{"apple", "banana", "carrot"};
+    std::vector<uint32_t> expectedRand{2, ListReader::NULL_INDEX, 1};
+    EXPECT_EQ(expectedData, data);
+    EXPECT_EQ(expectedRand, randIndices);
+
+    // End is reported as soon as the last record is returned
+    ListReader again(outFile);
+    EXPECT_EQ(ReadStatus::Ok, again.next(record));
+    EXPECT_EQ(ReadStatus::Ok, again.next(record));
+    EXPECT_EQ(ReadStatus::Ok, again.status());
+    EXPECT_EQ(ReadStatus::Ok, again.next(record));
+    EXPECT_EQ(ReadStatus::End, again.status());
+    EXPECT_EQ(ReadStatus::End, again.next(record));
+}
+
+TEST(ListReaderTest, ReportsErrors) {
+    ListReader missing("no_such_file.out");
+    EXPECT_EQ(ReadStatus::OpenError, missing.status());
+
+    // 1 node, dataLen 5, only 2 data bytes
+    std::istringstream truncated(std::string("\x01\x00\x00\x00\x05\x00\x00\x00" "ap", 10));
+    ListReader shortRead(truncated);
+    ListRecord record;
+    EXPECT_EQ(ReadStatus::ReadError, shortRead.next(record));
+    EXPECT_EQ(ReadStatus::ReadError, shortRead.next(record));
+
+    // 1 node, dataLen 1001
+    std::istringstream tooBig(std::string("\x01\x00\x00\x00\xE9\x03\x00\x00", 8));
+    ListReader invalid(tooBig);
+    EXPECT_EQ(ReadStatus::InvalidDataSize, invalid.next(record));
+}
+
+TEST_F(ListSerializerTest, CloneIsDeepCopy) {
+    LinkedList copy = list.clone();
+    EXPECT_EQ(list.size(), copy.size());
+    EXPECT_TRUE(list == copy);
+
+    // copy shares no nodes or rand targets with source
+    auto srcIt = list.begin();
+    for (auto &node : copy) {
+        EXPECT_NE(&*srcIt, &node);
+        if (node.rand) {
+            EXPECT_NE(srcIt->rand, node.rand);
+        }
+        ++srcIt;
+    }
+    EXPECT_EQ(list.end(), srcIt);
+
+    copy.begin()->data = "changed";
+    EXPECT_EQ("apple", list.begin()->data);
+    EXPECT_FALSE(list == copy);
+
+    LinkedList empty;
+    EXPECT_TRUE(empty.clone().empty());
+}
+
+// Payload recording the thread its destructor runs on
+struct Tracked {
+    int value = 0;
+    bool blocker = false; // blocks reclaimer thread until gate opens
+
+    bool operator==(const Tracked &) const = default;
+    ~Tracked();
+};
+
+namespace {
+std::atomic<bool> tracking{false};
+std::thread::id callerThread;
+std::atomic<int> releasedOnCaller{0};
+std::atomic<int> releasedOnWorker{0};
+std::promise<void> *blockerStarted = nullptr;
+std::latch *gate = nullptr;
+
+BasicLinkedList<Tracked> makeTracked(int count, bool blocker = false) {
+    std::vector<Tracked> data(count);
+    std::vector<uint32_t> randIndices(count, 0);
+    for (int i = 0; i < count; ++i) {
+        data[i] = Tracked{i, blocker};
+    }
+    return ListBuilder::fromMemory(data, randIndices);
+}
+
+// list is destroyed on calling thread, or queued to its reclaimer
+void destroy(BasicLinkedList<Tracked> /*list*/) {}
+} // namespace
+
+Tracked::~Tracked() {
+    if (!tracking)
+        return;
+    bool onCaller = std::this_thread::get_id() == callerThread;
+    ++(onCaller ? releasedOnCaller : releasedOnWorker);
+    if (blocker && !onCaller) {
+        blockerStarted->set_value();
+        gate->wait();
+    }
+}
+
+struct ListReclaimerTest : public ::testing::Test {
+    virtual void SetUp() override {
+        callerThread = std::this_thread::get_id();
+        releasedOnCaller = 0;
+        releasedOnWorker = 0;
+    }
+
+    virtual void TearDown() override { tracking = false; }
+};
+
+TEST_F(ListReclaimerTest, ReleasesOnWorkerThread) {
+    const int n = 1000;
+    BasicLinkedList<Tracked> snapshot;
+    {
+        ListReclaimer reclaimer;
+        BasicLinkedList<Tracked> list = makeTracked(n);
+        list.setReclaimer(&reclaimer);
+        // clone doesn't inherit reclaimer, may outlive it
+        snapshot = list.clone();
+
+        tracking = true;
+        destroy(std::move(list));
+        EXPECT_EQ(0, releasedOnCaller);
+
+        reclaimer.drain();
+        EXPECT_EQ(0u, reclaimer.pending());
+        EXPECT_EQ(n, releasedOnWorker);
+    }
+    destroy(std::move(snapshot));
+    EXPECT_EQ(n, releasedOnCaller);
+}
+
+TEST_F(ListReclaimerTest, ReleasesInlineWhenQueueFull) {
+    std::promise<void> started;
+    std::latch open(1);
+    blockerStarted = &started;
+    gate = &open;
+
+    ListReclaimer reclaimer(1);
+    BasicLinkedList<Tracked> blocking = makeTracked(1, true);
+    BasicLinkedList<Tracked> queued = makeTracked(2);
+    BasicLinkedList<Tracked> full = makeTracked(3);
+    blocking.setReclaimer(&reclaimer);
+    queued.setReclaimer(&reclaimer);
+    full.setReclaimer(&reclaimer);
+
+    tracking = true;
+    destroy(std::move(blocking));
+    // reclaimer thread is busy, queue is empty
+    ASSERT_EQ(std::future_status::ready,
+              started.get_future().wait_for(std::chrono::seconds(5)))
+        << "blocking list wasn't released on reclaimer thread";
+
+    destroy(std::move(queued)); // takes the only queue slot
+    EXPECT_EQ(0, releasedOnCaller);
+
+    destroy(std::move(full)); // queue full: released on this thread
+    EXPECT_EQ(3, releasedOnCaller);
+
+    open.count_down();
+    reclaimer.drain();
+    EXPECT_EQ(1 + 2, releasedOnWorker);
+    EXPECT_EQ(3, releasedOnCaller);
+}
+
+TEST_F(ListReclaimerTest, MoveAssignedListKeepsReclaimer) {
+    ListReclaimer reclaimer;
+    BasicLinkedList<Tracked> target = makeTracked(2);
+    target.setReclaimer(&reclaimer);
+    BasicLinkedList<Tracked> fresh = makeTracked(3);
+
+    tracking = true;
+    target = std::move(fresh); // old nodes go to reclaimer
+    EXPECT_EQ(3u, target.size());
+    EXPECT_TRUE(fresh.empty());
+
+    destroy(std::move(target)); // moved-to parameter takes the reclaimer
+    EXPECT_EQ(0, releasedOnCaller);
+
+    reclaimer.drain();
+    EXPECT_EQ(2 + 3, releasedOnWorker);
+}
+
+TEST(CloneTest, ConstListFromTwoThreads) {
+    const size_t n = 10000;
+    std::vector<std::string> data(n);
+    std::vector<uint32_t> randIndices(n);
+    for (size_t i = 0; i < n; ++i) {
+        data[i] = std::to_string(i);
+        randIndices[i] = static_cast<uint32_t>((i * 7919) % (n + 1));
+    }
+    const LinkedList source = ListBuilder::fromMemory(data, randIndices);
+    const LinkedList sourceCopy = source.clone();
+
+    bool equal[2] = {true, true};
+    auto cloneMany = [&](bool &ok) {
+        for (int i = 0; i < 20; ++i) {
+            LinkedList copy = source.clone();
+            ok = ok && (copy == source);
+        }
+    };
+    std::thread first(cloneMany, std::ref(equal[0]));
+    std::thread second(cloneMany, std::ref(equal[1]));
+    first.join();
+    second.join();
+
+    EXPECT_TRUE(equal[0]);
+    EXPECT_TRUE(equal[1]);
+    EXPECT_TRUE(sourceCopy.clone() == source);
+}
+
+TEST(FixedSizeSerializerTest, RejectsUnsafePayloads) {
+    struct Padded {
+        char c = 0;
+        int32_t x = 0;
+        bool operator==(const Padded &) const = default;
+    };
+
+    static_assert(FixedSizePayload<uint32_t>);
+    static_assert(FixedSizePayload<double>);
+    static_assert(!FixedSizePayload<Padded>);
+    static_assert(!FixedSizePayload<int *>);
+    static_assert(!FixedSizePayload<bool>);
+    static_assert(SerializablePayload<std::string>);
+}